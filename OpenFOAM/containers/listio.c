@@ -31,6 +31,7 @@ License
 #include "token.H"
 #include "SLList.H"
 #include "contiguous.H"
+#include "readAsciiNumeric.H"
 
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
@@ -109,7 +110,17 @@ Istream& List<T>::readList(Istream& is)
 
             if (len)
             {
-                if (delimiter == token::BEGIN_LIST)
+                if
+                (
+                    delimiter == token::BEGIN_LIST
+                 && Detail::readAsciiNumeric(is, list.data(), len)
+                )
+                {
+                    // Numeric contents read directly from the characters,
+                    // including the end of contents marker
+                    return is;
+                }
+                else if (delimiter == token::BEGIN_LIST)
                 {
                     for (label i=0; i<len; ++i)
                     {
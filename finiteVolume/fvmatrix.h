@@ -238,6 +238,17 @@ protected:
                 const bool couples=true
             ) const;
 
+            //- Translate the segregated solver controls into those of the
+            //- component-independent LduMatrix solvers and check that the
+            //- components can share the diagonal and interface coefficients
+            //- of the first valid component cmpt0
+            bool batchedSolverControls
+            (
+                const dictionary& solverControls,
+                dictionary& batchedControls,
+                direction& cmpt0
+            ) const;
+
 
         // Matrix manipulation functionality
 
@@ -595,6 +606,12 @@ public:
             //  Use the given solver controls
             SolverPerformance<Type> solveSegregated(const dictionary&);
 
+            //- Solve the components segregated but in a single pass over
+            //- the matrix, returning the solution statistics.
+            //  Falls back to solveSegregated if the components cannot be
+            //  batched. Use the given solver controls
+            SolverPerformance<Type> solveSegregatedBatched(const dictionary&);
+
             //- Solve coupled returning the solution statistics.
             //  Use the given solver controls
             SolverPerformance<Type> solveCoupled(const dictionary&);